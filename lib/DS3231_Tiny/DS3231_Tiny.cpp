@@ -187,3 +187,44 @@ void rtcClearAlarm2() {
   TinyWireM.endTransmission();
 }
 #endif
+
+#ifdef DS3231_TEMP
+int16_t rtcReadTemp() {
+  // 0x11 = signed integer part, 0x12 bits 7-6 = fraction (0.25C steps)
+  TinyWireM.beginTransmission(DS3231_ADDR);
+  TinyWireM.write(0x11);
+  TinyWireM.endTransmission();
+  TinyWireM.requestFrom(DS3231_ADDR, 2);
+  uint8_t msb = TinyWireM.read();
+  uint8_t lsb = TinyWireM.read();
+  return (int16_t)((msb << 8) | lsb) >> 6;
+}
+#endif
+
+#ifdef DS3231_AGING
+int8_t rtcReadAging() {
+  TinyWireM.beginTransmission(DS3231_ADDR);
+  TinyWireM.write(0x10);
+  TinyWireM.endTransmission();
+  TinyWireM.requestFrom(DS3231_ADDR, 1);
+  return (int8_t)TinyWireM.read();
+}
+
+void rtcWriteAging(int8_t offset) {
+  TinyWireM.beginTransmission(DS3231_ADDR);
+  TinyWireM.write(0x10);
+  TinyWireM.write((uint8_t)offset);
+  TinyWireM.endTransmission();
+  // Force a temperature conversion (CONV) so the new offset applies now
+  // instead of at the next 64s TCXO cycle
+  TinyWireM.beginTransmission(DS3231_ADDR);
+  TinyWireM.write(0x0E);
+  TinyWireM.endTransmission();
+  TinyWireM.requestFrom(DS3231_ADDR, 1);
+  uint8_t ctrl = TinyWireM.read();
+  TinyWireM.beginTransmission(DS3231_ADDR);
+  TinyWireM.write(0x0E);
+  TinyWireM.write(ctrl | 0x20);  // set CONV, preserve alarm bits
+  TinyWireM.endTransmission();
+}
+#endif
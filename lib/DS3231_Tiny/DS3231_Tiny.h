@@ -4,6 +4,8 @@
 // Feature flags -- define before including to enable
 // #define DS3231_DATE     // date read/write
 // #define DS3231_ALARM2   // alarm 2 support
+// #define DS3231_TEMP     // die temperature read
+// #define DS3231_AGING    // aging offset read/write
 
 #include <Arduino.h>
 
@@ -33,4 +35,13 @@ bool rtcCheckAlarm2();
 void rtcClearAlarm2();
 #endif
 
+#ifdef DS3231_TEMP
+int16_t rtcReadTemp();  // quarter degrees C
+#endif
+
+#ifdef DS3231_AGING
+int8_t rtcReadAging();
+void rtcWriteAging(int8_t offset);  // +1 LSB ~ -0.1ppm at 25C
+#endif
+
 #endif
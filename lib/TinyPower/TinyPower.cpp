@@ -0,0 +1,55 @@
+#include "TinyPower.h"
+#include <avr/sleep.h>
+#include <avr/power.h>
+#include <util/delay.h>
+
+// Bandgap is nominally 1.1V; 1100mV * 1023 = 1125300. Trim per chip if
+// the reading needs to be better than ~10%.
+#define VCC_BANDGAP_SCALE 1125300UL
+
+static uint16_t adcConvert() {
+  ADCSRA |= _BV(ADSC);
+  while (ADCSRA & _BV(ADSC));
+  return ADC;
+}
+
+uint16_t vccRead() {
+  power_adc_enable();
+  ADMUX = _BV(MUX3) | _BV(MUX2);  // REFS=VCC, input=Vbg (MUX 1100)
+  ADCSRA |= _BV(ADEN);
+  _delay_ms(1);                   // bandgap settle after mux switch
+  adcConvert();                   // first result after enable is discarded
+  uint16_t adc = adcConvert();
+  ADCSRA &= ~_BV(ADEN);           // ADC off between samples
+  power_adc_disable();            // PRADC only after ADEN is cleared
+  return adc ? VCC_BANDGAP_SCALE / adc : 0;
+}
+
+void cpuClock(uint8_t shift) {
+  uint8_t sreg = SREG;  // callable from ISRs: restore, don't force sei()
+  cli();
+  CLKPR = _BV(CLKPCE);  // timed sequence: new value within 4 cycles
+  CLKPR = shift;
+  SREG = sreg;
+}
+
+void powerInit() {
+  ADCSRA &= ~_BV(ADEN);  // core init() leaves the ADC enabled
+  ACSR |= _BV(ACD);      // analog comparator off
+  power_adc_disable();
+  power_timer1_disable();
+}
+
+void powerSleep() {
+  power_usi_disable();
+  set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+  cli();
+  sleep_enable();
+#if defined(BODS) && defined(BODSE)
+  sleep_bod_disable();   // timed: sleep_cpu() must follow within 3 cycles
+#endif
+  sei();
+  sleep_cpu();
+  sleep_disable();
+  power_usi_enable();    // TinyWireM needs the USI; Timer0 was never gated
+}
@@ -0,0 +1,26 @@
+#ifndef TINY_POWER_H
+#define TINY_POWER_H
+
+#include <Arduino.h>
+
+// Supply voltage in mV, measured as the internal 1.1V bandgap against VCC.
+// Powers the ADC up for the sample and back down afterwards.
+uint16_t vccRead();
+
+// CPU clock prescaler (CLKPR), as a power-of-two shift of F_CPU.
+// millis(), delay() and TinyWireM's USI bit delays are compiled for F_CPU,
+// so they all run 2^shift slower while prescaled: keep timing-sensitive
+// code at CPU_DIV_1 and only prescale work that does not consult them.
+#define CPU_DIV_1  0   // 8 MHz
+#define CPU_DIV_8  3   // 1 MHz
+void cpuClock(uint8_t shift);
+
+// Gate peripherals the firmware never clocks (Timer1, ADC outside
+// vccRead()) through PRR and switch off the analog comparator.
+void powerInit();
+
+// Power-down sleep with the USI gated and BOD disabled for the duration.
+// Caller arms the wake sources (PCINT/WDT); USI is re-clocked on wake.
+void powerSleep();
+
+#endif
@@ -2,17 +2,18 @@
 #include <avr/pgmspace.h>
 #include <Tiny4kOLED_common.h>
 
-// Custom 8x16 font: ASCII 32-58 (space through colon)
-// 27 glyphs x 16 bytes = 432 bytes
+// Custom 8x16 font: ASCII 32-60 (space through '<')
+// 29 glyphs x 16 bytes = 464 bytes
 //
 // Symbol icons in unused ASCII slots:
 //   ! hourglass (TIMER)    " stopwatch (STOPWTCH)  # clock (CLOCK)
 //   $ bell (ALARM)         % checkmark (OK)        & plus (+1)
 //   ' minus (-1)           ( play (START/GO)       ) stop (STOP)
 //   , flag (LAP)           - caret (setting indicator)
-//   . reset (RESET)        / X-mark (OFF)
+//   . reset (RESET)        / X-mark (OFF)      * battery (LOW BATT)
+//   + moon (NIGHT)         ; thermometer (TEMP)    < decimal point
 //
-// Generated by tools/gen_icons.py  edit pixel art there, not here.
+// Generated by tools/gen_icons.py — edit pixel art there, not here.
 const uint8_t chrono_font_data[] PROGMEM = {
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, //   32 space
   0x04,0x0C,0x94,0x64,0x94,0x0C,0x04,0x00,0x02,0x03,0x02,0x02,0x02,0x03,0x02,0x00, // ! 33 hourglass (TIMER)
@@ -24,8 +25,8 @@ const uint8_t chrono_font_data[] PROGMEM = {
   0x00,0x60,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ' 39 minus (-1)
   0x00,0xFE,0xFC,0xF8,0xF0,0xE0,0xC0,0x80,0x00,0x7F,0x3F,0x1F,0x0F,0x07,0x03,0x01, // ( 40 play (START/GO)
   0x00,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0x00,0x00,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x00, // ) 41 stop (STOP)
-  0x00,0x2A,0x1C,0x3E,0x1C,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // * 42 (unused)
-  0x00,0x20,0x20,0xFC,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00, // + 43 (unused)
+  0x00,0xFC,0x06,0x06,0xFC,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,0x00, // * 42 battery (LOW BATT)
+  0x78,0xFC,0x86,0x02,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00, // + 43 moon (NIGHT)
   0x00,0x00,0xFF,0x1E,0x1E,0x1E,0x1E,0x1E,0x00,0x40,0x7F,0x40,0x00,0x00,0x00,0x00, // , 44 flag (LAP)
   0x00,0x10,0x18,0x1C,0x1C,0x18,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // - 45 caret (setting indicator)
   0x78,0x84,0x02,0x02,0x02,0x12,0x9C,0x78,0x38,0x30,0x21,0x01,0x01,0x01,0x00,0x00, // . 46 reset (RESET)
@@ -41,6 +42,8 @@ const uint8_t chrono_font_data[] PROGMEM = {
   0x00,0x70,0x88,0x08,0x08,0x88,0x70,0x00,0x00,0x1C,0x22,0x21,0x21,0x22,0x1C,0x00, // 8 56
   0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x00,0x00,0x31,0x22,0x22,0x11,0x0F,0x00, // 9 57
   0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00, // : 58
+  0x00,0x00,0xFE,0xF1,0xF1,0xFE,0x00,0x00,0x06,0x0F,0x1F,0x1F,0x1F,0x1F,0x0F,0x06, // ; 59 thermometer (TEMP)
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00, // < 60 decimal point
 };
 
 const DCfont chronoFont = {
@@ -48,7 +51,7 @@ const DCfont chronoFont = {
   8,  // width in pixels
   2,  // height in pages (8 pixels each)
   32, // first ASCII
-  58, // last ASCII
+  60, // last ASCII
   0, 0, 0
 };
 
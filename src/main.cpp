@@ -1,56 +1,167 @@
-#include <avr/sleep.h>
 #include <avr/interrupt.h>
 #include <avr/wdt.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
 #include <TinyWireM.h>
 #include <Tiny4kOLED.h>
 #include <DS3231_Tiny.h>
+#include <TinyPower.h>
 #include "font_chrono.h"
+#include "pins.h"
 
 #define BTN_SET   PB3
 #define BTN_START PB4
 #define BUZZER    PB1
 
+typedef PinB<BTN_SET>   PinSet;
+typedef PinB<BTN_START> PinStart;
+typedef PinB<BUZZER>    PinBuzzer;
+
 #define DEBOUNCE_MS    50
 #define LONG_PRESS_MS  1000
+#define REPEAT_ARM_MS  300   // press again within this of a tap to repeat
+#define REPEAT_MS      240   // first repeat interval, halves every 8 repeats
+#define REPEAT_FRAME_MS 100  // min redraw interval while repeating
+
+#define IDLE_TIMEOUT_MS       15000
+#define IDLE_TIMEOUT_LOW_MS   5000
+#define ALARM_BEEP_MS         2000
+#define ALARM_BEEP_LOW_MS     5000
+#define CONTRAST_FULL         0x7F  // SSD1306 reset value
+#define CONTRAST_LOW          0x08
+#define CONTRAST_FACE         0x04
+#define CONTRAST_NIGHT        0x01
+#define FACE_PAGE             3     // low-power face: one 16-row band
+
+// Battery governor: steps are cumulative as VCC sags (3xAAA, ~4.5V fresh)
+#define GOV_NO_SECONDS  1  // low-power clock face drops seconds, 8s WDT
+#define GOV_DIM         2  // OLED contrast lowered
+#define GOV_SHORT_IDLE  3  // inactivity timeout 15s -> 5s
+#define GOV_SLOW_BEEP   4  // alarm re-beep 2s -> 5s
+#define GOV_LEVELS      4
+#define GOV_CONFIRM     5  // consecutive low samples before each step
+const uint16_t govThresholdMv[GOV_LEVELS] = { 4000, 3800, 3600, 3400 };
+
+// Night schedule: display profile by RTC hour, switched on DS3231 Alarm 2.
+// Transitions happen at dim/dark/full hours, in that order round the clock.
+enum Profile { PROFILE_DIM, PROFILE_DARK, PROFILE_FULL, PROFILE_COUNT };
+uint8_t eeSchedule[PROFILE_COUNT] EEMEM = { 0xFF, 0xFF, 0xFF };  // erased = off
+
+// Drift tracking: each manual clock set is logged against the previous one
+// and nudges the DS3231 aging offset (0x10, ~0.1ppm/LSB) toward zero drift.
+#define DRIFT_MIN_ELAPSED_S   1209600UL // 14 days: +-1s over two sets < 0.9ppm
+#define DRIFT_MAX_ERROR_S     120       // larger = re-set/DST, not drift
+#define DRIFT_MAX_STEP        20        // aging LSBs per correction
+#define DRIFT_LOG_LEN         4
+
+struct DriftEntry {
+  uint32_t elapsed;  // seconds covered by this estimate
+  int16_t error;     // RTC minus set time, seconds (+ = RTC fast)
+  int8_t tempC;      // DS3231 die temperature at the correction
+  int8_t aging;      // aging offset in effect after this correction
+};
+
+uint32_t eeDriftBase EEMEM = 0xFFFFFFFF;  // true time at interval start
+int16_t eeDriftCarry EEMEM = 0;           // error already reset this interval
+uint8_t eeDriftHead EEMEM = 0;
+DriftEntry eeDriftLog[DRIFT_LOG_LEN] EEMEM;
+
+// Power-loss checkpoint, written at state transitions to a ring of slots.
+// The newest slot is the one before the first break in the seq chain, so
+// boot reads CKPT_SLOTS seq bytes plus a single record.
+#define CKPT_SLOTS  8
+
+struct Checkpoint {
+  uint8_t seq;
+  uint8_t state;     // mode | subState << 2 | swLapVisible << 4
+  uint16_t target;   // timer targetSeconds
+  uint16_t lap;      // swLapSecs
+  uint32_t accum;    // swAccum (ms) before the current run
+  uint32_t anchor;   // secondsSince2000: timer deadline or stopwatch start
+  uint8_t crc;       // CRC-8 over the bytes above
+};
+
+Checkpoint eeCkpt[CKPT_SLOTS] EEMEM;
+
+// Temperature log: DS3231 die temperature every LOG_INTERVAL_MIN, stored as
+// signed 4-bit deltas (0.25C) in EEPROM blocks that each carry their own
+// half-degree base, so the oldest block can be overwritten without losing
+// the reference. Deltas clamp at +-1.75C; the encoder tracks the clamped
+// value so any shortfall is made up on the next sample.
+#define LOG_INTERVAL_MIN  15
+#define LOG_BLOCKS        20   // 20 x 28 samples, ~5.8 days at 15 min
+#define LOG_NIBBLES       28
+#define LOG_EMPTY         0x8  // -8 is never written as a delta
+#define LOG_TREND         4    // trend over 4 samples (1 hour at 15 min)
+
+struct LogBlock {
+  uint8_t seq;               // mod 255; 0xFF = never written
+  int8_t base;               // 0.5C reference for the first delta
+  uint8_t nibbles[LOG_NIBBLES / 2];
+};
+
+LogBlock eeLog[LOG_BLOCKS] EEMEM;
+uint8_t eeLogResetSeq EEMEM = 0xFF;  // min/max reset point: block seq...
+uint8_t eeLogResetCount EEMEM;       // ...and samples in it at the reset
 
 struct Button {
-  uint8_t pin;
+  uint8_t mask;
   bool lastRaw;
   bool pressed;
   uint32_t pressStart;
   bool handled;
+  bool repeating;        // tap-then-hold: streams EVT_REPEAT, never EVT_LONG
+  uint8_t repeats;
+  uint32_t nextRepeat;
+  uint32_t lastTap;      // release time of the last short press
 };
 
-enum ButtonEvent { EVT_NONE, EVT_SHORT, EVT_LONG };
+enum ButtonEvent { EVT_NONE, EVT_SHORT, EVT_LONG, EVT_REPEAT };
 
-Button btnA = { BTN_SET,   false, false, 0, false };
-Button btnB = { BTN_START, false, false, 0, false };
+Button btnA = { PinSet::mask,   false, false, 0, false };
+Button btnB = { PinStart::mask, false, false, 0, false };
 
-ButtonEvent readButton(Button &b) {
-  bool raw = !digitalRead(b.pin);
+// pins is one PINB sample shared by both buttons for this loop iteration.
+// With repeat set, a press that follows a tap within REPEAT_ARM_MS repeats
+// while held (accelerating) instead of becoming a long press.
+ButtonEvent readButton(Button &b, uint8_t pins, bool repeat) {
+  bool raw = !(pins & b.mask);
+  uint32_t now = millis();
   ButtonEvent evt = EVT_NONE;
 
   // Detect press start with debounce
   if (raw && !b.pressed) {
     if (!b.lastRaw) {
-      b.pressStart = millis();
-    } else if (millis() - b.pressStart >= DEBOUNCE_MS) {
+      b.pressStart = now;
+    } else if (now - b.pressStart >= DEBOUNCE_MS) {
       b.pressed = true;
       b.handled = false;
+      b.repeating = repeat && b.pressStart - b.lastTap < REPEAT_ARM_MS;
+      b.repeats = 0;
+      b.nextRepeat = b.pressStart + REPEAT_ARM_MS;
     }
   }
 
+  // Auto-repeat while held: 240, 120, then 60ms
+  if (b.pressed && b.repeating && raw && (int32_t)(now - b.nextRepeat) >= 0) {
+    evt = EVT_REPEAT;
+    b.handled = true;
+    if (b.repeats < 16) b.repeats++;
+    b.nextRepeat = now + (REPEAT_MS >> (b.repeats / 8));
+  }
+
   // Detect long press while held
-  if (b.pressed && !b.handled && raw &&
-      millis() - b.pressStart >= LONG_PRESS_MS) {
+  if (b.pressed && !b.handled && !b.repeating && raw &&
+      now - b.pressStart >= LONG_PRESS_MS) {
     evt = EVT_LONG;
     b.handled = true;
   }
 
   // Detect short press on release
   if (b.pressed && !raw) {
-    if (!b.handled && millis() - b.pressStart >= DEBOUNCE_MS) {
+    if (!b.handled && now - b.pressStart >= DEBOUNCE_MS) {
       evt = EVT_SHORT;
+      b.lastTap = now;
     }
     b.pressed = false;
   }
@@ -61,7 +172,7 @@ ButtonEvent readButton(Button &b) {
 
 volatile bool wakeFlag = false;
 
-enum Mode { MODE_TIMER, MODE_STOPWATCH, MODE_CLOCK, MODE_COUNT };
+enum Mode { MODE_TIMER, MODE_STOPWATCH, MODE_CLOCK, MODE_TEMP, MODE_COUNT };
 enum SubState { SUB_IDLE, SUB_SETTING, SUB_RUNNING, SUB_DONE };
 
 Mode currentMode = MODE_TIMER;
@@ -83,27 +194,113 @@ uint8_t rtcHour, rtcMin, rtcSec;
 uint8_t alarmHour = 0, alarmMin = 0;
 bool alarmEnabled = false;
 
-uint8_t settingField;             // 0=hour, 1=min
+uint8_t settingField;             // 0=hour, 1=min, clock 2=armed (schedule: 0..2)
 uint8_t settingHour, settingMin;  // temp values during edit
+uint8_t settingFromHour, settingFromMin;  // clock time when the edit began
 bool settingAlarm;                // true=alarm, false=clock
+bool settingSched;                // editing the night schedule hours
+uint8_t settingSchedHours[PROFILE_COUNT];
 bool alarmFired = false;          // prevent re-trigger within same minute
 
-void goToSleep() {
-  oled.off();
-  oled.clear();
-  oled.on();
+uint8_t govLevel = 0;             // battery governor step, only steps down
+uint8_t govMin = 0xFF;            // RTC minute of last VCC sample
+uint8_t govLow = 0;               // consecutive samples below next step
+uint8_t faceMin = 0xFF;           // minute last drawn on low-power face
+bool displayDirty = false;        // redraw pending from auto-repeat
+
+uint8_t schedHours[PROFILE_COUNT];  // start hour of each profile
+Profile schedProfile = PROFILE_FULL;
+
+// Defined further down; setup() runs them at boot
+void logInit();
+void schedApply();
+void ckptRestore();
+void updateDisplay();
+
+bool schedEnabled() {
+  return schedHours[PROFILE_DIM] < 24 &&
+         (schedHours[PROFILE_DIM] != schedHours[PROFILE_DARK] ||
+          schedHours[PROFILE_DARK] != schedHours[PROFILE_FULL]);
+}
 
+// Low contrast and no face seconds, from either the governor or the schedule
+bool displayDimmed() {
+  return govLevel >= GOV_DIM || schedProfile != PROFILE_FULL;
+}
+
+bool faceSeconds() {
+  return govLevel < GOV_NO_SECONDS && schedProfile == PROFILE_FULL;
+}
+
+void oledContrast() {
+  oled.setContrast(displayDimmed() ? CONTRAST_LOW : CONTRAST_FULL);
+}
+
+// begin() only replays the init list, so settings the face profile changes
+// outside it are put back explicitly.
+void oledInit() {
+  oled.begin(128, 64, sizeof(tiny4koled_init_128x64br), tiny4koled_init_128x64br);
+  oled.setFont(FONT_CHRONO);
+  oled.setDisplayStartLine(0);
+  oled.setMultiplexRatio(64);
+  oled.setDisplayClock(1, 8);       // reset default
+  oled.setPrechargePeriod(1, 15);   // as in the bright init
+  oledContrast();
+}
+
+// Sample VCC once per RTC minute. Levels only ratchet down (a sagging cell
+// recovers a little when idle); a battery swap resets via power-on. The
+// bandgap is only +-10% and a single sample can catch a load dip, so each
+// step needs GOV_CONFIRM consecutive readings below its threshold.
+void govTick() {
+  if (rtcMin == govMin) return;
+  govMin = rtcMin;
+  if (govLevel >= GOV_LEVELS) return;
+  // The WDT face pass runs at 1 MHz; vccRead()'s _delay_ms() assumes F_CPU
+  // and the ADC clock would drop below 50 kHz, so sample at full speed
+  uint8_t shift = CLKPR & 0x0F;
+  cpuClock(CPU_DIV_1);
+  uint16_t mv = vccRead();
+  cpuClock(shift);
+  if (mv >= govThresholdMv[govLevel]) {
+    govLow = 0;
+    return;
+  }
+  if (++govLow < GOV_CONFIRM) return;
+  govLow = 0;
+  govLevel++;
+  if (!clockLowPower) oledContrast();
+}
+
+// Low-power display profile: scan only the 16 rows of the face band
+// (start line at FACE_PAGE, mux 16), drop the oscillator and divider to
+// hold the frame rate near the 64-row one, and shorten pre-charge.
+// oledInit() restores the full configuration on wake.
+void oledFaceProfile() {
+  oled.setDisplayStartLine(FACE_PAGE * 8);
+  oled.setMultiplexRatio(16);
+  oled.setDisplayClock(4, 0);
+  oled.setPrechargePeriod(1, 2);
+  oled.setContrast(schedProfile == PROFILE_FULL ? CONTRAST_FACE : CONTRAST_NIGHT);
+}
+
+// Power down until a button or SQW edge on PB3/PB4
+void pinSleep() {
   GIMSK |= _BV(PCIE);
   PCMSK |= _BV(PCINT3) | _BV(PCINT4);
 
-  set_sleep_mode(SLEEP_MODE_PWR_DOWN);
-  sleep_enable();
-  sleep_cpu();
+  powerSleep();
+}
 
-  sleep_disable();
+void goToSleep() {
+  // Panel stays off; the wake path re-inits and redraws before oled.on()
+  oled.off();
+  oled.clear();
+  pinSleep();
 }
 
 ISR(PCINT0_vect) {
+  cpuClock(CPU_DIV_1);  // interactive: back to full speed before loop() runs
   wakeFlag = true;
 }
 
@@ -115,36 +312,53 @@ void clockSleep() {
   // Enable PCINT for button wake
   GIMSK |= _BV(PCIE);
   PCMSK |= _BV(PCINT3) | _BV(PCINT4);
-  // Enable WDT interrupt, ~1s
+  // Enable WDT interrupt, ~1s (~8s once seconds are hidden)
   cli();
   WDTCR |= _BV(WDCE) | _BV(WDE);
-  WDTCR = _BV(WDIE) | _BV(WDP2) | _BV(WDP1);
-  sei();
-  set_sleep_mode(SLEEP_MODE_PWR_DOWN);
-  sleep_enable();
-  sleep_cpu();
-  sleep_disable();
+  if (!faceSeconds()) {
+    WDTCR = _BV(WDIE) | _BV(WDP3) | _BV(WDP0);
+  } else {
+    WDTCR = _BV(WDIE) | _BV(WDP2) | _BV(WDP1);
+  }
+  // A PCINT during this pass (button, Alarm 1) already set wakeFlag: stay
+  // at 8 MHz and let loop() take the full wake rather than sleeping on it.
+  // Interrupts stay off until powerSleep()'s sei; sleep_cpu pair.
+  if (wakeFlag) {
+    sei();
+    return;
+  }
+  // Background WDT wakes resume at 1 MHz: no millis()/delay() on that path
+  cpuClock(CPU_DIV_8);
+  powerSleep();
 }
 
 void setup() {
-  pinMode(BTN_SET, INPUT_PULLUP);
-  pinMode(BTN_START, INPUT_PULLUP);
-  pinMode(BUZZER, OUTPUT);
-  digitalWrite(BUZZER, HIGH);  // buzzer off (active-low)
+  powerInit();
+  PinSet::inputPullup();
+  PinStart::inputPullup();
+  PinBuzzer::high();           // buzzer off (active-low)
+  PinBuzzer::output();
 
   TinyWireM.begin();
-  oled.begin(128, 64, sizeof(tiny4koled_init_128x64br), tiny4koled_init_128x64br);
-  oled.setFont(FONT_CHRONO);
+  oledInit();
+  rtcRead(rtcHour, rtcMin, rtcSec);
+  govTick();
   oled.clear();
   oled.on();
   alarmEnabled = rtcReadAlarm(alarmHour, alarmMin);
   rtcClearAlarm();  // ensure SQW is HIGH on boot
+  rtcClearAlarm2();
+  eeprom_read_block(schedHours, eeSchedule, sizeof(schedHours));
+  logInit();
+  schedApply();
+  ckptRestore();
+  updateDisplay();
 }
 
 void beep() {
-  digitalWrite(BUZZER, LOW);
+  PinBuzzer::low();
   delay(150);
-  digitalWrite(BUZZER, HIGH);
+  PinBuzzer::high();
 }
 
 void print2(uint8_t val) {
@@ -152,6 +366,367 @@ void print2(uint8_t val) {
   oled.print(val);
 }
 
+// Quarter degrees as [-]D.D; the font's '-' is the caret, so minus uses '\''
+void printTemp(int16_t q) {
+  if (q < 0) {
+    oled.print("'");
+    q = -q;
+  }
+  oled.print(q >> 2);
+  oled.print("<");                   // decimal point
+  oled.print((q & 3) * 25 / 10);
+}
+
+// Low-power clock readout on the face band; seconds blanked when dimmed.
+// Only the changed digits are sent: the WDT wake runs prescaled, so every
+// I2C byte costs 8x the bus time.
+void printClockTime() {
+  if (rtcMin != faceMin) {
+    faceMin = rtcMin;
+    oled.setCursor(0, FACE_PAGE);
+    print2(rtcHour);
+    oled.print(":");
+    print2(rtcMin);
+    oled.print(faceSeconds() ? ":" : "   ");
+  }
+  if (faceSeconds()) {
+    oled.setCursor(48, FACE_PAGE);
+    print2(rtcSec);
+  }
+}
+
+// Bell and battery share the readout band so only 16 rows are lit
+void enterClockFace() {
+  clockLowPower = true;
+  isSleeping = false;
+  oledInit();
+  oled.clear();
+  if (alarmEnabled) {
+    oled.setCursor(80, FACE_PAGE);
+    oled.print("$");
+  }
+  if (govLevel > 0) {
+    oled.setCursor(96, FACE_PAGE);
+    oled.print("*");
+  }
+  faceMin = 0xFF;
+  printClockTime();
+  oledFaceProfile();
+  oled.on();
+}
+
+uint8_t logHead = LOG_BLOCKS - 1;   // block being filled
+uint8_t logSeq = 254;
+uint8_t logCount = LOG_NIBBLES;     // samples in head block; full = start new
+uint16_t logSamples = 0;            // samples seen since boot/replay
+int16_t logLast, logMin, logMax, logTrend;  // 0.25C
+int16_t logHist[LOG_TREND];
+uint8_t logHistIdx = 0;
+
+// Incremental min/max and trend, fed by new samples and by the boot replay
+void logStats(int16_t v) {
+  if (logSamples == 0) {
+    logMin = logMax = v;
+    for (uint8_t i = 0; i < LOG_TREND; i++) logHist[i] = v;
+  }
+  if (v < logMin) logMin = v;
+  if (v > logMax) logMax = v;
+  logTrend = v - logHist[logHistIdx];
+  logHist[logHistIdx] = v;
+  logHistIdx = (logHistIdx + 1) % LOG_TREND;
+  logLast = v;
+  if (logSamples < 0xFFFF) logSamples++;
+}
+
+void logSample() {
+  int16_t t = rtcReadTemp();
+  if (logCount >= LOG_NIBBLES) {
+    // Next block: fill with empty markers and base first, seq last, so a
+    // power cut mid-write leaves the block outside the seq chain
+    logHead = (logHead + 1) % LOG_BLOCKS;
+    logSeq = (logSeq + 1) % 255;
+    logCount = 0;
+    int8_t base = t >> 1;
+    for (uint8_t i = 0; i < LOG_NIBBLES / 2; i++) {
+      eeprom_update_byte(&eeLog[logHead].nibbles[i], LOG_EMPTY * 0x11);
+    }
+    eeprom_update_byte((uint8_t *)&eeLog[logHead].base, base);
+    eeprom_update_byte(&eeLog[logHead].seq, logSeq);
+    // A reset point from 255 blocks ago must not match the reused seq
+    if (eeprom_read_byte(&eeLogResetSeq) == logSeq) {
+      eeprom_update_byte(&eeLogResetSeq, 0xFF);
+    }
+    logLast = base * 2;
+  }
+  int8_t d = constrain(t - logLast, -7, 7);
+  uint8_t *p = &eeLog[logHead].nibbles[logCount >> 1];
+  uint8_t b = eeprom_read_byte(p);
+  if (logCount & 1) b = (b & 0x0F) | ((d & 0x0F) << 4);
+  else b = (b & 0xF0) | (d & 0x0F);
+  eeprom_update_byte(p, b);
+  logCount++;
+  logStats(logLast + d);
+}
+
+// Restart min/max from the latest sample, and record where in the log that
+// happened so the boot replay restarts them at the same point
+void logResetMinMax() {
+  logMin = logMax = logLast;
+  eeprom_update_byte(&eeLogResetCount, logCount);
+  eeprom_update_byte(&eeLogResetSeq, logSeq);
+}
+
+// Find the newest block from the seq chain and replay every written block,
+// oldest first, to rebuild min/max/trend and the head block fill level.
+void logInit() {
+  uint8_t seq = eeprom_read_byte(&eeLog[0].seq);
+  if (seq == 0xFF) return;  // never written
+  uint8_t head = 0;
+  while (head < LOG_BLOCKS - 1) {
+    uint8_t next = eeprom_read_byte(&eeLog[head + 1].seq);
+    if (next != (seq + 1) % 255) break;
+    seq = next;
+    head++;
+  }
+  logHead = head;
+  logSeq = seq;
+  uint8_t resetSeq = eeprom_read_byte(&eeLogResetSeq);
+  uint8_t resetCount = eeprom_read_byte(&eeLogResetCount);
+  for (uint8_t i = 1; i <= LOG_BLOCKS; i++) {
+    uint8_t blk = (head + i) % LOG_BLOCKS;
+    uint8_t blkSeq = eeprom_read_byte(&eeLog[blk].seq);
+    if (blkSeq == 0xFF) continue;
+    int16_t v = (int8_t)eeprom_read_byte((uint8_t *)&eeLog[blk].base) * 2;
+    uint8_t n = 0;
+    for (; n < LOG_NIBBLES; n++) {
+      uint8_t b = eeprom_read_byte(&eeLog[blk].nibbles[n >> 1]);
+      uint8_t nib = (n & 1) ? b >> 4 : b & 0x0F;
+      if (nib == LOG_EMPTY) break;
+      v += (nib & 0x08) ? (int8_t)nib - 16 : nib;
+      logStats(v);
+      if (blkSeq == resetSeq && n + 1 == resetCount) logMin = logMax = v;
+    }
+    logCount = n;  // ends on the head block
+  }
+}
+
+// Alarm 2 is shared by the schedule and the logger: arm it for whichever
+// comes first. Minutes ahead run 1..1440, so a transition due this minute
+// is taken as the next day's.
+void alarm2Arm() {
+  uint16_t now = rtcHour * 60 + rtcMin;
+  uint16_t ahead = 1440;
+  if (schedEnabled()) {
+    for (uint8_t p = 0; p < PROFILE_COUNT; p++) {
+      uint16_t a = (schedHours[p] * 60 + 1439 - now) % 1440 + 1;
+      if (a < ahead) ahead = a;
+    }
+  }
+  uint16_t a = LOG_INTERVAL_MIN - now % LOG_INTERVAL_MIN;
+  if (a < ahead) ahead = a;
+  uint16_t at = (now + ahead) % 1440;
+  rtcSetAlarm2(at / 60, at % 60);
+}
+
+// Pick the profile whose start hour most recently passed. Equal hours
+// collapse a window (later one wins).
+void schedApply() {
+  schedProfile = PROFILE_FULL;
+  if (schedEnabled()) {
+    uint8_t since = 24;
+    for (uint8_t p = 0; p < PROFILE_COUNT; p++) {
+      uint8_t ago = (rtcHour + 24 - schedHours[p]) % 24;
+      if (ago <= since) {
+        since = ago;
+        schedProfile = (Profile)p;
+      }
+    }
+  }
+  alarm2Arm();
+  if (!clockLowPower && !isSleeping) oledContrast();
+}
+
+// Alarm 2 fired: clear it, take a log sample if one is due, switch profile
+// and re-arm for the next event. SQW rising as A2F clears is a PB4 pin
+// change, so PCINT4 alone is masked across the clear (a masked pin does
+// not set PCIF); otherwise the ISR would re-set wakeFlag and loop() would
+// do a full wake. PB3 stays live, so a button A edge is never lost.
+void alarm2Service() {
+  uint8_t pcmsk = PCMSK;
+  PCMSK &= ~_BV(PCINT4);
+  rtcClearAlarm2();
+  // Let the pull-up finish the rising edge before unmasking
+  for (uint8_t i = 0; i < 50 && PinStart::isLow(); i++) delayMicroseconds(2);
+  PCMSK = pcmsk;
+  rtcRead(rtcHour, rtcMin, rtcSec);
+  if (rtcMin % LOG_INTERVAL_MIN == 0) logSample();
+  schedApply();
+}
+
+// Awake: Alarm 2 holds PB4 low like button B. Clear it and drop the
+// phantom press.
+void alarm2Poll() {
+  if (!rtcCheckAlarm2()) return;
+  btnB = { PinStart::mask, false, false, 0, false };
+  alarm2Service();
+}
+
+// Service an Alarm 2 wake without lighting the panel. Returns true when
+// that was the only cause and the caller can go back to sleep.
+bool alarm2BackgroundWake() {
+  TinyWireM.begin();
+  if (!rtcCheckAlarm2()) return false;
+  Profile was = schedProfile;
+  alarm2Service();
+  // SQW still low means Alarm 1 fired too; either pin low may be a button,
+  // and wakeFlag set again means a button edge arrived during the service
+  if (wakeFlag || PinSet::isLow() || PinStart::isLow()) return false;
+  // PCINT stays armed while awake: never pull the user out of an edit or
+  // a ringing alarm, only restyle an idle clock
+  bool idle = isSleeping || clockLowPower || subState == SUB_IDLE;
+  if (currentMode == MODE_CLOCK && schedProfile != was && idle) {
+    if (schedProfile == PROFILE_DARK) {
+      // Panel off until a button or alarm; no WDT wakes
+      clockLowPower = false;
+      wdt_disable();
+      isSleeping = true;
+    } else {
+      enterClockFace();
+    }
+  }
+  return true;
+}
+
+uint32_t secondsSince2000(uint8_t hour, uint8_t min, uint8_t sec) {
+  static const uint16_t monthDays[12] = { 0, 31, 59, 90, 120, 151,
+                                          181, 212, 243, 273, 304, 334 };
+  uint8_t day, month, year;
+  rtcReadDate(day, month, year);
+  uint16_t days = year * 365 + (year + 3) / 4 + monthDays[month - 1] + day - 1;
+  if (month > 2 && year % 4 == 0) days++;
+  return days * 86400UL + hour * 3600UL + min * 60 + sec;
+}
+
+// Called right after a manual clock set, with the RTC time read just
+// before the write (h:m:sec) and the time that was written. Errors from sets
+// closer together than DRIFT_MIN_ELAPSED_S are carried into one interval;
+// once it is long enough, half the measured drift is applied to the aging
+// offset so noisy sets still converge.
+void driftCorrect(uint8_t h, uint8_t m, uint8_t sec, uint8_t hour, uint8_t min) {
+  uint32_t now = secondsSince2000(h, m, sec);
+  int32_t error = (h * 3600L + m * 60 + sec) - (hour * 3600L + min * 60);
+  if (error > 43200) error -= 86400;
+  else if (error < -43200) error += 86400;
+
+  uint32_t base = eeprom_read_dword(&eeDriftBase);
+  int32_t total = (int16_t)eeprom_read_word((uint16_t *)&eeDriftCarry) + error;
+  int16_t carry = 0;
+  bool restart = true;
+  if (base != 0xFFFFFFFF && now > base &&
+      total >= -DRIFT_MAX_ERROR_S && total <= DRIFT_MAX_ERROR_S) {
+    uint32_t elapsed = now - base;
+    if (elapsed >= DRIFT_MIN_ELAPSED_S) {
+      int32_t tenthsPpm = total * 10000000L / (int32_t)elapsed;
+      int16_t step = constrain(tenthsPpm / 2, -DRIFT_MAX_STEP, DRIFT_MAX_STEP);
+      int8_t aging = constrain(rtcReadAging() + step, -127, 127);
+      rtcWriteAging(aging);
+
+      DriftEntry e = { elapsed, (int16_t)total, (int8_t)(rtcReadTemp() >> 2), aging };
+      uint8_t head = eeprom_read_byte(&eeDriftHead) % DRIFT_LOG_LEN;
+      eeprom_update_block(&e, &eeDriftLog[head], sizeof(e));
+      eeprom_update_byte(&eeDriftHead, (head + 1) % DRIFT_LOG_LEN);
+    } else {
+      carry = total;  // keep the baseline, accumulate
+      restart = false;
+    }
+  }
+  // New interval starts at the corrected time (also after a re-set/DST jump)
+  if (restart) eeprom_update_dword(&eeDriftBase, now - error);
+  eeprom_update_word((uint16_t *)&eeDriftCarry, carry);
+}
+
+uint8_t ckptCrc(const Checkpoint &c) {
+  uint8_t crc = 0;
+  const uint8_t *p = (const uint8_t *)&c;
+  for (uint8_t i = 0; i < sizeof(c) - 1; i++) crc = _crc8_ccitt_update(crc, p[i]);
+  return crc;
+}
+
+uint8_t ckptHead = CKPT_SLOTS - 1;  // slot of the newest record
+uint8_t ckptSeq = 0xFF;
+
+void ckptSave() {
+  rtcRead(rtcHour, rtcMin, rtcSec);
+  uint32_t now = secondsSince2000(rtcHour, rtcMin, rtcSec);
+  Checkpoint c;
+  c.seq = ++ckptSeq;
+  c.state = currentMode | (subState << 2) | (swLapVisible << 4);
+  c.target = targetSeconds;
+  c.lap = swLapSecs;
+  c.accum = swAccum;
+  c.anchor = 0;
+  if (subState == SUB_RUNNING) {
+    c.anchor = (currentMode == MODE_TIMER) ? now + currentSeconds
+                                           : now - (millis() - swStart) / 1000;
+  }
+  c.crc = ckptCrc(c);
+  ckptHead = (ckptHead + 1) % CKPT_SLOTS;
+  // Body first, seq last: a write torn by a battery sag leaves the slot's
+  // old seq, which is outside the chain, so restore stops at the previous one
+  eeprom_update_block((const uint8_t *)&c + 1, (uint8_t *)&eeCkpt[ckptHead] + 1,
+                      sizeof(c) - 1);
+  eeprom_update_byte(&eeCkpt[ckptHead].seq, c.seq);
+}
+
+// Restore mode and timer/stopwatch state after a reset. Running timers
+// resume from their RTC deadline (or ring if it passed during the outage);
+// a running stopwatch adds the time it was powered off.
+void ckptRestore() {
+  uint8_t seq = eeprom_read_byte(&eeCkpt[0].seq);
+  uint8_t head = 0;
+  while (head < CKPT_SLOTS - 1) {
+    uint8_t next = eeprom_read_byte(&eeCkpt[head + 1].seq);
+    if (next != (uint8_t)(seq + 1)) break;
+    seq = next;
+    head++;
+  }
+  ckptHead = head;
+  ckptSeq = seq;
+
+  // A bad newest record falls back to the one before it
+  Checkpoint c;
+  for (uint8_t tries = 0; ; tries++) {
+    eeprom_read_block(&c, &eeCkpt[head], sizeof(c));
+    if (c.crc == ckptCrc(c)) break;
+    if (tries) return;
+    head = (head + CKPT_SLOTS - 1) % CKPT_SLOTS;
+  }
+
+  currentMode = (Mode)(c.state & 0x03);
+  subState = (SubState)((c.state >> 2) & 0x03);
+  swLapVisible = c.state & 0x10;
+  targetSeconds = c.target;
+  swLapSecs = c.lap;
+  swAccum = c.accum;
+  if (currentMode >= MODE_COUNT) currentMode = MODE_TIMER;
+  if (subState == SUB_SETTING || currentMode >= MODE_CLOCK) subState = SUB_IDLE;
+
+  if (subState == SUB_RUNNING) {
+    uint32_t now = secondsSince2000(rtcHour, rtcMin, rtcSec);
+    if (currentMode == MODE_TIMER) {
+      if (c.anchor > now && c.anchor - now <= targetSeconds) {
+        currentSeconds = c.anchor - now;
+      } else {
+        currentSeconds = 0;
+        subState = SUB_DONE;
+      }
+    } else {
+      if (now > c.anchor) swAccum += (now - c.anchor) * 1000;
+      swStart = millis();
+    }
+  }
+}
+
 void drawSoftKeys(const char* left, const char* right) {
   oled.setCursor(0, 6);
   oled.print(left);
@@ -172,10 +747,17 @@ void updateDisplay() {
     oled.print("!");       // hourglass
   } else if (currentMode == MODE_STOPWATCH) {
     oled.print("\x22");    // stopwatch
+  } else if (currentMode == MODE_TEMP) {
+    oled.print(";");       // thermometer
   }
 
-  // Current time in upper right (timer/stopwatch only)
-  if (currentMode == MODE_TIMER || currentMode == MODE_STOPWATCH) {
+  if (govLevel > 0) {
+    oled.setCursor(16, 0);
+    oled.print("*");       // battery low
+  }
+
+  // Current time in upper right (all but clock)
+  if (currentMode != MODE_CLOCK) {
     oled.setCursor(88, 0);
     print2(rtcHour);
     oled.print(":");
@@ -242,6 +824,18 @@ void updateDisplay() {
       oled.print(":");
       print2(alarmMin);
       drawSoftKeys("%", "%");        // check / check
+    } else if (subState == SUB_SETTING && settingSched) {
+      oled.setCursor(0, 0);
+      oled.print("+");               // moon
+      oled.setCursor(0, 2);
+      print2(settingSchedHours[PROFILE_DIM]);
+      oled.print(" ");
+      print2(settingSchedHours[PROFILE_DARK]);
+      oled.print(" ");
+      print2(settingSchedHours[PROFILE_FULL]);
+      oled.setCursor(settingField * 24, 4);
+      oled.print("--");
+      drawSoftKeys("&", "'%");      // up / down+check
     } else if (subState == SUB_SETTING) {
       oled.setCursor(0, 0);
       oled.print(settingAlarm ? "$" : "#"); // bell or clock icon
@@ -249,10 +843,15 @@ void updateDisplay() {
       print2(settingHour);
       oled.print(":");
       print2(settingMin);
+      if (settingField == 2) oled.print(":00");  // armed: press A at :00
       // Caret under the field being edited
-      oled.setCursor(settingField == 0 ? 0 : 24, 4);
+      oled.setCursor(settingField * 24, 4);
       oled.print("--");             // two caret indicators
-      drawSoftKeys("&", "'%");      // up / down+check
+      if (settingField == 2) {
+        drawSoftKeys("%", "/");     // commit at :00 / cancel
+      } else {
+        drawSoftKeys("&", "'%");    // up / down+check
+      }
     } else {
       oled.setCursor(0, 0);
       oled.print("#");               // clock
@@ -280,9 +879,37 @@ void updateDisplay() {
     }
   }
 
+  if (currentMode == MODE_TEMP) {
+    oled.setCursor(0, 2);
+    printTemp(rtcReadTemp());
+
+    if (logSamples > 0) {
+      // Change over the last hour of samples
+      oled.setCursor(64, 2);
+      oled.print(logTrend < 0 ? "'" : "&");
+      printTemp(abs(logTrend));
+
+      oled.setCursor(0, 4);
+      printTemp(logMin);
+      oled.setCursor(64, 4);
+      printTemp(logMax);
+      drawSoftKeys(".", "");         // reset / _
+    }
+  }
+
   oled.on();
 }
 
+// Repeat events only mark the display dirty; loop() redraws at most once
+// per REPEAT_FRAME_MS so fast repeats are not throttled by full redraws.
+void refreshDisplay(ButtonEvent evt) {
+  if (evt == EVT_REPEAT) {
+    displayDirty = true;
+  } else {
+    updateDisplay();
+  }
+}
+
 void loop() {
   if (!wakeFlag && isSleeping) {
     goToSleep();
@@ -291,18 +918,19 @@ void loop() {
   // Clock low-power mode: MCU sleeps, wakes every ~1s to update time
   if (clockLowPower) {
     if (wakeFlag) {
-      // Button press or SQW: full wake
+      // Button press or SQW: full wake unless only the schedule fired
+      cpuClock(CPU_DIV_1);  // the ISR did, unless a WDT pass slowed it again
       wakeFlag = false;
+      if (alarm2BackgroundWake()) return;
       clockLowPower = false;
       wdt_disable();
-      btnA = { BTN_SET,   false, false, 0, false };
-      btnB = { BTN_START, false, false, 0, false };
+      btnA = { PinSet::mask,   false, false, 0, false };
+      btnB = { PinStart::mask, false, false, 0, false };
       TinyWireM.begin();
-      oled.begin(128, 64, sizeof(tiny4koled_init_128x64br), tiny4koled_init_128x64br);
-      oled.setFont(FONT_CHRONO);
-      oled.on();
+      oledInit();
       lastActivity = millis();
       rtcRead(rtcHour, rtcMin, rtcSec);
+      govTick();
       if (alarmEnabled && rtcCheckAlarm()) {
         rtcClearAlarm();
         subState = SUB_DONE;
@@ -315,12 +943,8 @@ void loop() {
       // WDT wake: update time only, sleep again
       TinyWireM.begin();
       rtcRead(rtcHour, rtcMin, rtcSec);
-      oled.setCursor(0, 3);
-      print2(rtcHour);
-      oled.print(":");
-      print2(rtcMin);
-      oled.print(":");
-      print2(rtcSec);
+      govTick();
+      printClockTime();
       clockSleep();
     }
     return;
@@ -328,15 +952,27 @@ void loop() {
 
   if (wakeFlag) {
     wakeFlag = false;
+    bool wasSleeping = isSleeping;
+    if (alarm2BackgroundWake()) {
+      // Quarter-hour log wakes: the panel is still off and blank, so skip
+      // goToSleep()'s off/clear (1KB of I2C) and power straight back down
+      // unless a button edge arrived since (checked with interrupts off)
+      cli();
+      if (wasSleeping && isSleeping && !wakeFlag) {
+        pinSleep();
+      } else {
+        sei();
+      }
+      return;
+    }
     isSleeping = false;
-    btnA = { BTN_SET,   false, false, 0, false };
-    btnB = { BTN_START, false, false, 0, false };
+    btnA = { PinSet::mask,   false, false, 0, false };
+    btnB = { PinStart::mask, false, false, 0, false };
     TinyWireM.begin();
-    oled.begin(128, 64, sizeof(tiny4koled_init_128x64br), tiny4koled_init_128x64br);
-    oled.setFont(FONT_CHRONO);
-    oled.on();
+    oledInit();
     lastActivity = millis();
     rtcRead(rtcHour, rtcMin, rtcSec);
+    govTick();
     if (alarmEnabled && rtcCheckAlarm()) {
       rtcClearAlarm();
       subState = SUB_DONE;
@@ -348,11 +984,22 @@ void loop() {
     updateDisplay();
   }
 
+  // Schedule/log event while awake: clear Alarm 2 so SQW releases PB4.
+  // Checked on a new PB4 low edge only, so a held B (long press,
+  // auto-repeat) does not poll the RTC every pass; the 1Hz block below
+  // catches an alarm that fires while B is already down.
+  {
+    static bool pb4Low = false;
+    bool low = PinStart::isLow();
+    if (low && !pb4Low) alarm2Poll();
+    pb4Low = PinStart::isLow();
+  }
+
   // Hardware alarm: DS3231 SQW pulls PB4 LOW via diode-OR
-  if (alarmEnabled && subState != SUB_DONE && !digitalRead(BTN_START)) {
+  if (alarmEnabled && subState != SUB_DONE && PinStart::isLow()) {
     if (rtcCheckAlarm()) {
       rtcClearAlarm();
-      btnB = { BTN_START, false, false, 0, false };  // prevent phantom press
+      btnB = { PinStart::mask, false, false, 0, false };  // prevent phantom press
       alarmFired = true;
       subState = SUB_DONE;
       rtcRead(rtcHour, rtcMin, rtcSec);
@@ -361,8 +1008,14 @@ void loop() {
     }
   }
 
-  ButtonEvent evtA = readButton(btnA);
-  ButtonEvent evtB = readButton(btnB);
+  // Value entry (timer minutes, clock/alarm/schedule fields) auto-repeats
+  bool repeat = subState == SUB_SETTING ||
+                (currentMode == MODE_TIMER && subState == SUB_IDLE);
+  uint8_t pins = PINB;
+  bool aHeld = btnA.pressed;
+  ButtonEvent evtA = readButton(btnA, pins, repeat);
+  ButtonEvent evtB = readButton(btnB, pins, repeat);
+  bool aDown = btnA.pressed && !aHeld;  // debounced press-down edge
 
   // Mode cycling (only from idle)
   if (evtA == EVT_LONG && subState == SUB_IDLE) {
@@ -375,6 +1028,7 @@ void loop() {
     swLapVisible = false;
     alarmFired = false;
     lastActivity = millis();
+    ckptSave();
     beep();
     updateDisplay();
   }
@@ -385,6 +1039,7 @@ void loop() {
     alarmFired = false;
     subState = SUB_IDLE;
     lastActivity = millis();
+    ckptSave();
     updateDisplay();
   }
 
@@ -394,6 +1049,7 @@ void loop() {
       if (evtA != EVT_NONE || evtB != EVT_NONE) {
         subState = SUB_IDLE;
         lastActivity = millis();
+        ckptSave();
         updateDisplay();
       }
     } else if (subState == SUB_RUNNING) {
@@ -401,27 +1057,29 @@ void loop() {
       if (evtB == EVT_LONG) {
         subState = SUB_IDLE;
         lastActivity = millis();
+        ckptSave();
         updateDisplay();
       }
     } else {
       // IDLE or SETTING: adjust time
-      if (evtA == EVT_SHORT) {
+      if (evtA == EVT_SHORT || evtA == EVT_REPEAT) {
         if (targetSeconds < 5940) targetSeconds += 60; // cap 99 min
         subState = SUB_SETTING;
         lastActivity = millis();
-        updateDisplay();
+        refreshDisplay(evtA);
       }
-      if (evtB == EVT_SHORT) {
+      if (evtB == EVT_SHORT || evtB == EVT_REPEAT) {
         if (targetSeconds >= 60) targetSeconds -= 60;
         subState = SUB_SETTING;
         lastActivity = millis();
-        updateDisplay();
+        refreshDisplay(evtB);
       }
       // Long B starts the timer
       if (evtB == EVT_LONG && targetSeconds > 0) {
         currentSeconds = targetSeconds;
         subState = SUB_RUNNING;
         lastActivity = millis();
+        ckptSave();
         beep();
         updateDisplay();
       }
@@ -437,6 +1095,7 @@ void loop() {
           updateDisplay();
         } else {
           subState = SUB_DONE;
+          ckptSave();
           beep();
           updateDisplay();
         }
@@ -454,6 +1113,7 @@ void loop() {
         subState = SUB_RUNNING;
       }
       lastActivity = millis();
+      ckptSave();
       updateDisplay();
     }
 
@@ -468,6 +1128,7 @@ void loop() {
         swLapVisible = false;
       }
       lastActivity = millis();
+      ckptSave();
       updateDisplay();
     }
 
@@ -486,10 +1147,11 @@ void loop() {
       if (evtA == EVT_SHORT) {
         // Enter time-setting
         rtcRead(rtcHour, rtcMin, rtcSec);
-        settingHour = rtcHour;
-        settingMin = rtcMin;
+        settingHour = settingFromHour = rtcHour;
+        settingMin = settingFromMin = rtcMin;
         settingField = 0;
         settingAlarm = false;
+        settingSched = false;
         subState = SUB_SETTING;
         lastActivity = millis();
         updateDisplay();
@@ -503,26 +1165,69 @@ void loop() {
           settingMin = alarmMin;
           settingField = 0;
           settingAlarm = true;
+          settingSched = false;
           subState = SUB_SETTING;
         }
         lastActivity = millis();
         updateDisplay();
       }
-    }
-    else if (subState == SUB_SETTING) {
-      // Unified setting handler (clock or alarm)
-      if (evtA == EVT_SHORT) {
-        if (settingField == 0) settingHour = (settingHour + 1) % 24;
-        else settingMin = (settingMin + 1) % 60;
+      if (evtB == EVT_LONG) {
+        // Night schedule: dim / dark / full start hours
+        for (uint8_t p = 0; p < PROFILE_COUNT; p++) {
+          settingSchedHours[p] = schedHours[p] < 24 ? schedHours[p] : 0;
+        }
+        settingField = 0;
+        settingSched = true;
+        subState = SUB_SETTING;
         lastActivity = millis();
         updateDisplay();
       }
-      if (evtB == EVT_SHORT) {
-        if (settingField == 0) settingHour = (settingHour == 0) ? 23 : settingHour - 1;
-        else settingMin = (settingMin == 0) ? 59 : settingMin - 1;
+    }
+    else if (subState == SUB_SETTING && !settingSched && !settingAlarm &&
+             settingField == 2) {
+      // Clock set armed: the write fires on the press-down of A, which the
+      // user times to :00 on a reference. Writing the seconds register
+      // restarts the DS3231 countdown chain, so the set lands on a seconds
+      // boundary instead of wherever a 1s long press happened to end.
+      if (aDown) {
+        btnA.handled = true;         // swallow the rest of this press
+        btnA.repeating = false;
+        // Write first: the drift bookkeeping (I2C, aging write, EEPROM)
+        // must not delay the set, or the next estimate counts the delay
+        uint8_t h, m, sec;
+        rtcRead(h, m, sec);
+        rtcWrite(settingHour, settingMin, 0);
+        driftCorrect(h, m, sec, settingHour, settingMin);
+        subState = SUB_IDLE;
+        beep();
+        rtcRead(rtcHour, rtcMin, rtcSec);
+        schedApply();
+        lastActivity = millis();
+        updateDisplay();
+      } else if (evtB != EVT_NONE) {
+        // Cancel
+        subState = SUB_IDLE;
         lastActivity = millis();
+        rtcRead(rtcHour, rtcMin, rtcSec);
         updateDisplay();
       }
+    }
+    else if (subState == SUB_SETTING) {
+      // Unified setting handler (clock, alarm or schedule hours)
+      uint8_t &val = settingSched ? settingSchedHours[settingField]
+                   : (settingField == 0 ? settingHour : settingMin);
+      uint8_t range = (!settingSched && settingField == 1) ? 60 : 24;
+      uint8_t lastField = settingSched ? PROFILE_COUNT - 1 : 1;
+      if (evtA == EVT_SHORT || evtA == EVT_REPEAT) {
+        val = (val + 1) % range;
+        lastActivity = millis();
+        refreshDisplay(evtA);
+      }
+      if (evtB == EVT_SHORT || evtB == EVT_REPEAT) {
+        val = (val == 0) ? range - 1 : val - 1;
+        lastActivity = millis();
+        refreshDisplay(evtB);
+      }
       if (evtA == EVT_LONG) {
         // Cancel
         subState = SUB_IDLE;
@@ -531,22 +1236,28 @@ void loop() {
         updateDisplay();
       }
       if (evtB == EVT_LONG) {
-        if (settingField == 0) {
-          settingField = 1;
+        if (settingField < lastField) {
+          settingField++;
           beep();
         } else {
           // Save
-          if (settingAlarm) {
+          if (settingSched) {
+            memcpy(schedHours, settingSchedHours, sizeof(schedHours));
+            eeprom_update_block(schedHours, eeSchedule, sizeof(schedHours));
+          } else if (settingAlarm) {
             alarmHour = settingHour;
             alarmMin = settingMin;
             alarmEnabled = true;
             rtcSetAlarm(alarmHour, alarmMin);
-          } else {
-            rtcWrite(settingHour, settingMin, 0);
+          } else if (settingHour != settingFromHour ||
+                     settingMin != settingFromMin) {
+            settingField = 2;        // arm; the write waits for the :00 press
           }
-          subState = SUB_IDLE;
+          // An unchanged clock time is not re-written (and not logged)
+          if (settingField != 2) subState = SUB_IDLE;
           beep();
           rtcRead(rtcHour, rtcMin, rtcSec);
+          schedApply();
         }
         lastActivity = millis();
         updateDisplay();
@@ -554,48 +1265,59 @@ void loop() {
     }
   }
 
-  // 1Hz RTC read (all modes); auto-refresh display in clock idle
+  if (currentMode == MODE_TEMP) {
+    if (evtA == EVT_SHORT && logSamples > 0) {
+      // Restart min/max from the latest sample; the EEPROM log is kept
+      logResetMinMax();
+      lastActivity = millis();
+      updateDisplay();
+    }
+  }
+
+  // 1Hz RTC read (all modes); auto-refresh display in clock/temp idle
   {
     static uint32_t lastRtcRead = 0;
     if (millis() - lastRtcRead >= 1000) {
       lastRtcRead = millis();
       rtcRead(rtcHour, rtcMin, rtcSec);
-      if (currentMode == MODE_CLOCK && subState == SUB_IDLE) {
+      govTick();
+      if (PinStart::isLow()) alarm2Poll();
+      if (currentMode >= MODE_CLOCK && subState == SUB_IDLE) {
         updateDisplay();
       }
     }
   }
 
+  // Coalesced redraw for auto-repeat edits
+  {
+    static uint32_t lastFrame = 0;
+    if (displayDirty && millis() - lastFrame >= REPEAT_FRAME_MS) {
+      lastFrame = millis();
+      displayDirty = false;
+      updateDisplay();
+    }
+  }
+
   // Repeating alarm beep (timer done or clock alarm)
   if (subState == SUB_DONE) {
     static uint32_t lastAlarmBeep = 0;
-    if (millis() - lastAlarmBeep >= 2000) {
+    uint16_t beepMs = (govLevel >= GOV_SLOW_BEEP) ? ALARM_BEEP_LOW_MS : ALARM_BEEP_MS;
+    if (millis() - lastAlarmBeep >= beepMs) {
       beep();
       lastAlarmBeep = millis();
     }
   }
 
-  // Auto-sleep after 15s inactivity (never during running/alarm/setting)
-  if (millis() - lastActivity > 15000 &&
+  // Auto-sleep after inactivity (never during running/alarm/setting)
+  uint16_t idleMs = (govLevel >= GOV_SHORT_IDLE) ? IDLE_TIMEOUT_LOW_MS : IDLE_TIMEOUT_MS;
+  if (millis() - lastActivity > idleMs &&
       subState != SUB_RUNNING &&
       subState != SUB_DONE &&
       subState != SUB_SETTING) {
-    if (currentMode == MODE_CLOCK) {
+    if (currentMode == MODE_CLOCK && schedProfile != PROFILE_DARK) {
       // Clock low-power: show only time, sleep between updates
-      clockLowPower = true;
-      oled.clear();
-      if (alarmEnabled) {
-        oled.setCursor(0, 0);
-        oled.print("$");
-      }
-      oled.setCursor(0, 3);
       rtcRead(rtcHour, rtcMin, rtcSec);
-      print2(rtcHour);
-      oled.print(":");
-      print2(rtcMin);
-      oled.print(":");
-      print2(rtcSec);
-      oled.on();
+      enterClockFace();
       clockSleep();
     } else {
       isSleeping = true;
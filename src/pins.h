@@ -0,0 +1,16 @@
+#pragma once
+#include <avr/io.h>
+
+// Compile-time PORTB pin access. The bit is a template constant, so each
+// call compiles to a single sbi/cbi/sbis/sbic instead of going through
+// digitalRead()/digitalWrite() and their pin-to-port lookup tables.
+template <uint8_t BIT>
+struct PinB {
+  static const uint8_t mask = _BV(BIT);
+
+  static inline void output()      { DDRB |= mask; }
+  static inline void inputPullup() { DDRB &= ~mask; PORTB |= mask; }
+  static inline void high()        { PORTB |= mask; }
+  static inline void low()         { PORTB &= ~mask; }
+  static inline bool isLow()       { return !(PINB & mask); }
+};
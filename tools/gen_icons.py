@@ -230,20 +230,17 @@ glyphs[(41, ') 41 stop (STOP)')] = """
 ........
 """
 
-# * and + are unused but must exist in the contiguous range 32-58.
-# Keeping original font data for these slots.
-
-glyphs[(42, '* 42 (unused)')] = """
-........
-.X.X.X..
-..XXX...
-.XXXXX..
-..XXX...
-.X.X.X..
-........
-........
-........
+glyphs[(42, '* 42 battery (LOW BATT)')] = """
 ........
+..XX....
+.XXXX...
+.X..X...
+.X..X...
+.X..X...
+.X..X...
+.X..X...
+.XXXX...
+.XXXX...
 ........
 ........
 ........
@@ -252,16 +249,16 @@ glyphs[(42, '* 42 (unused)')] = """
 ........
 """
 
-glyphs[(43, '+ 43 (unused)')] = """
+glyphs[(43, '+ 43 moon (NIGHT)')] = """
 ........
-........
-...X....
-...X....
-...X....
-.XXXXX..
-...X....
-...X....
-...X....
+..XXX...
+.XX.....
+XX......
+XX......
+XX......
+XX......
+.XX.....
+..XXX...
 ........
 ........
 ........
@@ -558,6 +555,44 @@ glyphs[(58, ': 58')] = """
 ........
 """
 
+glyphs[(59, '; 59 thermometer (TEMP)')] = """
+...XX...
+..X..X..
+..X..X..
+..X..X..
+..XXXX..
+..XXXX..
+..XXXX..
+..XXXX..
+.XXXXXX.
+XXXXXXXX
+XXXXXXXX
+.XXXXXX.
+..XXXX..
+........
+........
+........
+"""
+
+glyphs[(60, '< 60 decimal point')] = """
+........
+........
+........
+........
+........
+........
+........
+........
+........
+........
+........
+........
+...XX...
+...XX...
+........
+........
+"""
+
 # ============================================================
 # GENERATE font_chrono.h
 # ============================================================
@@ -566,15 +601,16 @@ HEADER = """#pragma once
 #include <avr/pgmspace.h>
 #include <Tiny4kOLED_common.h>
 
-// Custom 8x16 font: ASCII 32-58 (space through colon)
-// 27 glyphs x 16 bytes = 432 bytes
+// Custom 8x16 font: ASCII 32-60 (space through '<')
+// 29 glyphs x 16 bytes = 464 bytes
 //
 // Symbol icons in unused ASCII slots:
 //   ! hourglass (TIMER)    " stopwatch (STOPWTCH)  # clock (CLOCK)
 //   $ bell (ALARM)         % checkmark (OK)        & plus (+1)
 //   ' minus (-1)           ( play (START/GO)       ) stop (STOP)
 //   , flag (LAP)           - caret (setting indicator)
-//   . reset (RESET)        / X-mark (OFF)
+//   . reset (RESET)        / X-mark (OFF)      * battery (LOW BATT)
+//   + moon (NIGHT)         ; thermometer (TEMP)    < decimal point
 //
 // Generated by tools/gen_icons.py — edit pixel art there, not here.
 const uint8_t chrono_font_data[] PROGMEM = {
@@ -587,7 +623,7 @@ const DCfont chronoFont = {
   8,  // width in pixels
   2,  // height in pages (8 pixels each)
   32, // first ASCII
-  58, // last ASCII
+  60, // last ASCII
   0, 0, 0
 };
 